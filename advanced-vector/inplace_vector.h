@@ -0,0 +1,305 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace inplace_vector_detail {
+
+// Истинно, если T() допустимо в константном выражении. Такой конструктор по умолчанию
+// не может иметь наблюдаемых побочных эффектов
+template <typename T, typename = void>
+inline constexpr bool IS_CONSTEXPR_DEFAULT_CONSTRUCTIBLE = false;
+
+template <typename T>
+inline constexpr bool IS_CONSTEXPR_DEFAULT_CONSTRUCTIBLE<
+    T, std::void_t<std::integral_constant<bool, (static_cast<void>(T()), true)>>> = true;
+
+// Типы, которые можно хранить в обычном массиве и обрабатывать в constexpr-функциях:
+// литеральные типы с constexpr-конструктором по умолчанию, например структуры
+// с инициализаторами полей или std::string_view. Свободные ячейки массива
+// инициализируются значением по умолчанию, а элементы записываются присваиванием
+template <typename T>
+inline constexpr bool IS_CONSTEXPR_STORABLE = std::is_trivially_destructible_v<T>
+    && IS_CONSTEXPR_DEFAULT_CONSTRUCTIBLE<T> && std::is_move_assignable_v<T>;
+
+// Агрегаты в C++17 нельзя инициализировать круглыми скобками
+template <typename T, typename... Args>
+constexpr T MakeValue(Args&&... args) {
+    if constexpr (std::is_constructible_v<T, Args...>) {
+        return T(std::forward<Args>(args)...);
+    } else {
+        return T{std::forward<Args>(args)...};
+    }
+}
+
+template <typename T, size_t N, bool = IS_CONSTEXPR_STORABLE<T>>
+class InplaceStorage;
+
+// Хранилище для литеральных типов. Все операции допустимы в константных выражениях,
+// а специальные функции-члены генерируются компилятором
+template <typename T, size_t N>
+class InplaceStorage<T, N, true> {
+protected:
+    constexpr T* Data() noexcept {
+        return data_;
+    }
+
+    constexpr const T* Data() const noexcept {
+        return data_;
+    }
+
+    template <typename... Args>
+    constexpr void Construct(size_t index, Args&&... args) {
+        data_[index] = MakeValue<T>(std::forward<Args>(args)...);
+    }
+
+    constexpr void Destroy(size_t /*first*/, size_t /*last*/) noexcept {
+    }
+
+    // Инициализация нужна, чтобы массив можно было читать в константных выражениях C++17
+    T data_[N == 0 ? 1 : N]{};
+    size_t size_ = 0;
+};
+
+// Хранилище для остальных типов: элементы конструируются в сырой памяти
+template <typename T, size_t N>
+class InplaceStorage<T, N, false> {
+protected:
+    InplaceStorage() noexcept = default;
+
+    InplaceStorage(const InplaceStorage& other) {
+        std::uninitialized_copy_n(other.Data(), other.size_, Data());
+        size_ = other.size_;
+    }
+
+    InplaceStorage(InplaceStorage&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        std::uninitialized_move_n(other.Data(), other.size_, Data());
+        size_ = other.size_;
+    }
+
+    InplaceStorage& operator=(const InplaceStorage& rhs) {
+        if (this != &rhs) {
+            std::copy(rhs.Data(), rhs.Data() + std::min(rhs.size_, size_), Data());
+            if (rhs.size_ < size_) {
+                std::destroy_n(Data() + rhs.size_, size_ - rhs.size_);
+            } else {
+                std::uninitialized_copy_n(rhs.Data() + size_, rhs.size_ - size_, Data() + size_);
+            }
+            size_ = rhs.size_;
+        }
+        return *this;
+    }
+
+    InplaceStorage& operator=(InplaceStorage&& rhs) noexcept(std::is_nothrow_move_assignable_v<T>
+                                                              && std::is_nothrow_move_constructible_v<T>) {
+        if (this != &rhs) {
+            std::move(rhs.Data(), rhs.Data() + std::min(rhs.size_, size_), Data());
+            if (rhs.size_ < size_) {
+                std::destroy_n(Data() + rhs.size_, size_ - rhs.size_);
+            } else {
+                std::uninitialized_move_n(rhs.Data() + size_, rhs.size_ - size_, Data() + size_);
+            }
+            size_ = rhs.size_;
+        }
+        return *this;
+    }
+
+    ~InplaceStorage() {
+        std::destroy_n(Data(), size_);
+    }
+
+    T* Data() noexcept {
+        return reinterpret_cast<T*>(buffer_);
+    }
+
+    const T* Data() const noexcept {
+        return reinterpret_cast<const T*>(buffer_);
+    }
+
+    template <typename... Args>
+    void Construct(size_t index, Args&&... args) {
+        // Результат MakeValue инициализирует ячейку напрямую, без перемещения
+        new (Data() + index) T(MakeValue<T>(std::forward<Args>(args)...));
+    }
+
+    void Destroy(size_t first, size_t last) noexcept {
+        std::destroy(Data() + first, Data() + last);
+    }
+
+    alignas(T) unsigned char buffer_[sizeof(T) * (N == 0 ? 1 : N)];
+    size_t size_ = 0;
+};
+
+}  // namespace inplace_vector_detail
+
+// Вектор фиксированной ёмкости N, хранящий элементы внутри себя без обращения к куче.
+// Для литеральных типов с constexpr-конструктором по умолчанию все операции
+// доступны в константных выражениях.
+// При переполнении EmplaceBack/Emplace/Resize выбрасывают std::length_error,
+// а TryEmplaceBack возвращает nullptr
+template <typename T, size_t N>
+class InplaceVector : private inplace_vector_detail::InplaceStorage<T, N> {
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr iterator begin() noexcept {
+        return this->Data();
+    }
+
+    constexpr iterator end() noexcept {
+        return this->Data() + this->size_;
+    }
+
+    constexpr const_iterator begin() const noexcept {
+        return this->Data();
+    }
+
+    constexpr const_iterator end() const noexcept {
+        return this->Data() + this->size_;
+    }
+
+    constexpr const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    constexpr const_iterator cend() const noexcept {
+        return end();
+    }
+
+    constexpr InplaceVector() noexcept = default;
+
+    constexpr explicit InplaceVector(size_t size) {
+        Resize(size);
+    }
+
+    constexpr void Swap(InplaceVector& other) {
+        InplaceVector& shorter = this->size_ < other.size_ ? *this : other;
+        InplaceVector& longer = this->size_ < other.size_ ? other : *this;
+        for (size_t i = 0; i < shorter.size_; ++i) {
+            T tmp(std::move(shorter[i]));
+            shorter[i] = std::move(longer[i]);
+            longer[i] = std::move(tmp);
+        }
+        const size_t common_size = shorter.size_;
+        for (; shorter.size_ < longer.size_; ++shorter.size_) {
+            shorter.Construct(shorter.size_, std::move(longer[shorter.size_]));
+        }
+        longer.Destroy(common_size, longer.size_);
+        longer.size_ = common_size;
+    }
+
+    constexpr size_t Size() const noexcept {
+        return this->size_;
+    }
+
+    static constexpr size_t Capacity() noexcept {
+        return N;
+    }
+
+    constexpr const T& operator[](size_t index) const noexcept {
+        assert(index < this->size_);
+        return this->Data()[index];
+    }
+
+    constexpr T& operator[](size_t index) noexcept {
+        assert(index < this->size_);
+        return this->Data()[index];
+    }
+
+    // При исключении в конструкторе элемента в векторе остаются уже созданные элементы
+    constexpr void Resize(size_t new_size) {
+        if (new_size > N) {
+            throw std::length_error("InplaceVector capacity exceeded");
+        }
+        if (new_size < this->size_) {
+            this->Destroy(new_size, this->size_);
+            this->size_ = new_size;
+        }
+        for (; this->size_ < new_size; ++this->size_) {
+            this->Construct(this->size_);
+        }
+    }
+
+    constexpr void PushBack(const T& value) {
+        EmplaceBack(value);
+    }
+
+    constexpr void PushBack(T&& value) {
+        EmplaceBack(std::move(value));
+    }
+
+    constexpr void PopBack() noexcept {
+        if (this->size_ > 0) {
+            this->Destroy(this->size_ - 1, this->size_);
+            --this->size_;
+        }
+    }
+
+    template <typename... Args>
+    constexpr T& EmplaceBack(Args&&... args) {
+        if (this->size_ == N) {
+            throw std::length_error("InplaceVector capacity exceeded");
+        }
+        return UncheckedEmplaceBack(std::forward<Args>(args)...);
+    }
+
+    // Возвращает указатель на добавленный элемент или nullptr, если вектор заполнен
+    template <typename... Args>
+    constexpr T* TryEmplaceBack(Args&&... args) {
+        if (this->size_ == N) {
+            return nullptr;
+        }
+        return &UncheckedEmplaceBack(std::forward<Args>(args)...);
+    }
+
+    // Вызывающий гарантирует, что в векторе есть свободное место
+    template <typename... Args>
+    constexpr T& UncheckedEmplaceBack(Args&&... args) {
+        assert(this->size_ < N);
+        this->Construct(this->size_, std::forward<Args>(args)...);
+        return this->Data()[this->size_++];
+    }
+
+    template <typename... Args>
+    constexpr iterator Emplace(const_iterator pos, Args&&... args) {
+        const size_t position = pos - begin();
+        if (this->size_ == N) {
+            throw std::length_error("InplaceVector capacity exceeded");
+        }
+        // Аргументы могут ссылаться на элементы вектора, поэтому новый элемент
+        // создаётся в конце до сдвига и затем переносится на место
+        this->Construct(this->size_, std::forward<Args>(args)...);
+        ++this->size_;
+        if (position + 1 != this->size_) {
+            T new_s(std::move(this->Data()[this->size_ - 1]));
+            for (size_t i = this->size_ - 1; i > position; --i) {
+                this->Data()[i] = std::move(this->Data()[i - 1]);
+            }
+            this->Data()[position] = std::move(new_s);
+        }
+        return begin() + position;
+    }
+
+    constexpr iterator Erase(const_iterator pos) noexcept {
+        const size_t position = pos - begin();
+        for (size_t i = position + 1; i < this->size_; ++i) {
+            this->Data()[i - 1] = std::move(this->Data()[i]);
+        }
+        PopBack();
+        return begin() + position;
+    }
+
+    constexpr iterator Insert(const_iterator pos, const T& value) {
+        return Emplace(pos, value);
+    }
+
+    constexpr iterator Insert(const_iterator pos, T&& value) {
+        return Emplace(pos, std::move(value));
+    }
+};
@@ -1,9 +1,14 @@
 /* разместите свой код в этом файле */
+#include "inplace_vector.h"
+#include "ring_buffer.h"
 #include "vector.h"
 
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 
 namespace {
 
@@ -99,6 +104,82 @@ struct Obj {
     static inline int num_destroyed = 0;
 };
 
+// Агрегат с нелитеральным полем: хранится в сырой памяти InplaceVector
+struct Person {
+    int id = 0;
+    std::string name;
+};
+
+// Тип с пользовательским (не constexpr) конструктором по умолчанию
+struct CountedDefault {
+    CountedDefault() {
+        ++num_default_constructed;
+    }
+    int value = 0;
+
+    static inline int num_default_constructed = 0;
+};
+
+struct TableEntry {
+    int key;
+    int value;
+};
+
+// Литеральный тип с инициализаторами полей: конструктор по умолчанию нетривиален, но constexpr
+struct DefaultedEntry {
+    std::string_view name;
+    int value = 0;
+};
+
+// Таблица квадратов, построенная на этапе компиляции
+constexpr InplaceVector<TableEntry, 8> MakeSquaresTable() {
+    InplaceVector<TableEntry, 8> table;
+    for (int i = 0; i < 5; ++i) {
+        table.EmplaceBack(i, i * i);
+    }
+    table.Emplace(table.begin(), -1, 1);
+    table.Erase(table.begin() + 1);
+    return table;
+}
+
+constexpr InplaceVector<DefaultedEntry, 4> MakeNamedTable() {
+    InplaceVector<DefaultedEntry, 4> table(1);
+    table.EmplaceBack("one", 1);
+    table.EmplaceBack("two", 2);
+    table.Erase(table.begin());
+    return table;
+}
+
+constexpr InplaceVector<std::string_view, 4> MakeNames() {
+    InplaceVector<std::string_view, 4> names;
+    names.PushBack("beta");
+    names.Insert(names.begin(), "alpha");
+    names.Resize(3);
+    return names;
+}
+
+constexpr InplaceVector<int, 4> MakeIntVector() {
+    InplaceVector<int, 4> v(2);
+    v[0] = 10;
+    v.Insert(v.begin() + 1, 20);
+    v.PushBack(99);
+    v.PopBack();
+    v.PushBack(30);
+    InplaceVector<int, 4> other;
+    other.PushBack(1);
+    v.Swap(other);
+    other.Swap(v);
+    return v;
+}
+
+// Добавляет элемент в вектор из prefilled элементов и сообщает, удалось ли это
+constexpr bool TryEmplaceBackSucceeds(size_t prefilled) {
+    InplaceVector<int, 4> v(prefilled);
+    const int* added = v.TryEmplaceBack(40);
+    assert(added == nullptr ? v.Size() == prefilled : *added == 40 && v.Size() == prefilled + 1);
+    return added != nullptr;
+}
+
 }  // namespace
 
 void Test1() {
@@ -381,6 +462,318 @@ void Test5() {
     }
 }
 
+void Test6() {
+    const int ID = 42;
+    using namespace std::literals;
+    {
+        SpscRingBuffer<int> rb(5);
+        assert(rb.Capacity() == 8);
+        assert(rb.Empty());
+        for (int i = 0; i < 8; ++i) {
+            assert(rb.TryPush(i));
+        }
+        assert(!rb.TryPush(8));
+        assert(rb.Size() == 8);
+        int value = 0;
+        for (int i = 0; i < 8; ++i) {
+            assert(rb.TryPop(value));
+            assert(value == i);
+        }
+        assert(!rb.TryPop(value));
+    }
+    {
+        try {
+            SpscRingBuffer<int> rb(std::numeric_limits<size_t>::max());
+            assert(false && "Exception is expected");
+        } catch (const std::length_error&) {
+        }
+        // Число элементов допустимо, но их размер в байтах не помещается в size_t
+        try {
+            SpscRingBuffer<long long> rb(size_t(1) << 62);
+            assert(false && "Exception is expected");
+        } catch (const std::length_error&) {
+        }
+    }
+    {
+        Obj::ResetCounters();
+        {
+            SpscRingBuffer<Obj> rb(4);
+            assert(rb.TryEmplace(ID, "Ivan"s));
+            assert(Obj::num_constructed_with_id_and_name == 1);
+            assert(Obj::num_moved == 0);
+            assert(Obj::num_copied == 0);
+            assert(rb.TryEmplace(ID + 1));
+            Obj o;
+            assert(rb.TryPop(o));
+            assert(o.id == ID);
+            assert(Obj::GetAliveObjectCount() == 2);
+        }
+        // Деструктор буфера разрушает оставшиеся элементы
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        SpscRingBuffer<int> rb(8);
+        const int src[] = {1, 2, 3, 4, 5, 6};
+        assert(rb.TryPushBatch(std::begin(src), std::end(src)) == 6);
+        assert(rb.TryPushBatch(std::begin(src), std::end(src)) == 2);
+        int dst[10] = {};
+        assert(rb.TryPopBatch(dst, 10) == 8);
+        assert(dst[0] == 1 && dst[5] == 6 && dst[6] == 1 && dst[7] == 2);
+        // Проверяем переход через границу буфера
+        assert(rb.TryPushBatch(std::begin(src), std::end(src)) == 6);
+        assert(rb.TryPopBatch(dst, 3) == 3);
+        assert(dst[0] == 1 && dst[2] == 3);
+        assert(rb.Size() == 3);
+    }
+    {
+        const int COUNT = 100'000;
+        SpscRingBuffer<int> rb(64);
+        std::thread producer([&rb] {
+            for (int i = 0; i < COUNT; ++i) {
+                while (!rb.TryPush(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        int expected = 0;
+        int value = 0;
+        while (expected < COUNT) {
+            if (rb.TryPop(value)) {
+                assert(value == expected);
+                ++expected;
+            }
+        }
+        producer.join();
+        assert(rb.Empty());
+    }
+}
+
+void Test7() {
+    const int ID = 42;
+    using namespace std::literals;
+    {
+        MpmcRingBuffer<int> rb(4);
+        assert(rb.Capacity() == 4);
+        for (int i = 0; i < 4; ++i) {
+            assert(rb.TryPush(i));
+        }
+        assert(!rb.TryPush(4));
+        int value = 0;
+        for (int i = 0; i < 4; ++i) {
+            assert(rb.TryPop(value));
+            assert(value == i);
+        }
+        assert(!rb.TryPop(value));
+        assert(rb.Empty());
+    }
+    {
+        // Схеме с номерами последовательности нужно минимум две ячейки
+        MpmcRingBuffer<std::string> rb(1);
+        assert(rb.Capacity() == 2);
+        size_t pushed = 0;
+        while (rb.TryPush(std::to_string(pushed))) {
+            ++pushed;
+        }
+        assert(pushed == rb.Capacity());
+        assert(rb.Size() == pushed);
+        std::string value;
+        for (size_t i = 0; i < pushed; ++i) {
+            assert(rb.TryPop(value));
+            assert(value == std::to_string(i));
+        }
+        assert(!rb.TryPop(value));
+        assert(rb.Empty());
+    }
+    {
+        // Элементы типа char помещаются в память, а массив номеров последовательности — нет
+        try {
+            MpmcRingBuffer<char> rb(size_t(1) << 62);
+            assert(false && "Exception is expected");
+        } catch (const std::length_error&) {
+        }
+    }
+    {
+        Obj::ResetCounters();
+        {
+            MpmcRingBuffer<Obj> rb(2);
+            // Конструкторы Obj не объявлены noexcept, поэтому объект создаётся
+            // вне буфера и перемещается в ячейку
+            assert(rb.TryEmplace(ID));
+            assert(rb.TryEmplace(ID, "Ivan"s));
+            assert(Obj::num_constructed_with_id == 1);
+            assert(Obj::num_constructed_with_id_and_name == 1);
+            assert(Obj::num_moved == 2);
+            assert(Obj::num_copied == 0);
+            assert(!rb.TryEmplace(ID));
+            assert(Obj::GetAliveObjectCount() == 2);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        MpmcRingBuffer<int> rb(8);
+        const int src[] = {1, 2, 3, 4, 5, 6};
+        assert(rb.TryPushBatch(std::begin(src), std::end(src)) == 6);
+        assert(rb.TryPushBatch(std::begin(src), std::end(src)) == 2);
+        int dst[10] = {};
+        assert(rb.TryPopBatch(dst, 10) == 8);
+        assert(dst[0] == 1 && dst[5] == 6 && dst[7] == 2);
+    }
+    {
+        const int THREADS = 4;
+        const int COUNT_PER_THREAD = 25'000;
+        MpmcRingBuffer<int> rb(64);
+        std::atomic<long long> sum{0};
+        std::atomic<int> consumed{0};
+        Vector<std::thread> threads;
+        for (int t = 0; t < THREADS; ++t) {
+            threads.EmplaceBack([&rb] {
+                for (int i = 1; i <= COUNT_PER_THREAD; ++i) {
+                    while (!rb.TryPush(i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+            threads.EmplaceBack([&rb, &sum, &consumed] {
+                int value = 0;
+                while (consumed.load() < THREADS * COUNT_PER_THREAD) {
+                    if (rb.TryPop(value)) {
+                        sum += value;
+                        ++consumed;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        const long long expected_sum = 1LL * THREADS * COUNT_PER_THREAD * (COUNT_PER_THREAD + 1) / 2;
+        assert(consumed == THREADS * COUNT_PER_THREAD);
+        assert(sum == expected_sum);
+        assert(rb.Empty());
+    }
+}
+
+void Test8() {
+    constexpr auto table = MakeSquaresTable();
+    static_assert(table.Size() == 5);
+    static_assert(table.Capacity() == 8);
+    static_assert(table[0].key == -1 && table[0].value == 1);
+    static_assert(table[1].key == 1 && table[1].value == 1);
+    static_assert(table[4].key == 4 && table[4].value == 16);
+
+    constexpr auto v = MakeIntVector();
+    static_assert(v.Size() == 4);
+    static_assert(v[0] == 10 && v[1] == 20 && v[2] == 0 && v[3] == 30);
+
+    static_assert(TryEmplaceBackSucceeds(0));
+    static_assert(TryEmplaceBackSucceeds(3));
+    static_assert(!TryEmplaceBackSucceeds(4));
+
+    constexpr auto named = MakeNamedTable();
+    static_assert(named.Size() == 2);
+    static_assert(named[0].name == "one" && named[0].value == 1);
+    static_assert(named[1].name == "two" && named[1].value == 2);
+
+    constexpr auto names = MakeNames();
+    static_assert(names.Size() == 3);
+    static_assert(names[0] == "alpha" && names[1] == "beta" && names[2].empty());
+
+    int sum = 0;
+    for (const auto& entry : table) {
+        sum += entry.value;
+    }
+    assert(sum == 1 + 1 + 4 + 9 + 16);
+    static_assert(std::is_trivially_copyable_v<InplaceVector<int, 4>>);
+    static_assert(std::is_trivially_copyable_v<InplaceVector<TableEntry, 8>>);
+
+    {
+        // Пустой вектор не конструирует элементы сверх Size()
+        CountedDefault::num_default_constructed = 0;
+        InplaceVector<CountedDefault, 100> counted;
+        assert(counted.Size() == 0);
+        assert(CountedDefault::num_default_constructed == 0);
+        counted.Resize(3);
+        assert(CountedDefault::num_default_constructed == 3);
+        counted.EmplaceBack();
+        assert(CountedDefault::num_default_constructed == 4);
+    }
+}
+
+void Test9() {
+    const int ID = 42;
+    const size_t SIZE = 4;
+    using namespace std::literals;
+    {
+        Obj::ResetCounters();
+        {
+            InplaceVector<Obj, SIZE> v(2);
+            assert(Obj::num_default_constructed == 2);
+            auto& elem = v.EmplaceBack(ID, "Ivan"s);
+            assert(&elem == &v[2]);
+            assert(v[2].name == "Ivan"s);
+            assert(Obj::num_moved == 0);
+            assert(v.TryEmplaceBack(ID) != nullptr);
+            assert(v.TryEmplaceBack(ID) == nullptr);
+            try {
+                v.EmplaceBack(ID);
+                assert(false && "Exception is expected");
+            } catch (const std::length_error&) {
+            }
+            assert(v.Size() == SIZE);
+            assert(Obj::GetAliveObjectCount() == SIZE);
+
+            v.Erase(v.begin());
+            assert(v.Size() == SIZE - 1);
+            assert(v[1].id == ID);
+            v.Insert(v.begin(), Obj{ID + 1});
+            assert(v[0].id == ID + 1);
+            assert(v[2].id == ID);
+
+            InplaceVector<Obj, SIZE> v_copy(v);
+            assert(v_copy.Size() == SIZE);
+            assert(v_copy[0].id == ID + 1);
+            v_copy.Resize(1);
+            v_copy.Swap(v);
+            assert(v.Size() == 1);
+            assert(v_copy.Size() == SIZE);
+            v = v_copy;
+            assert(v.Size() == SIZE);
+            assert(v[3].id == ID);
+            assert(Obj::GetAliveObjectCount() == SIZE * 2);
+        }
+        assert(Obj::GetAliveObjectCount() == 0);
+    }
+    {
+        InplaceVector<Person, 2> people;
+        auto& person = people.EmplaceBack(ID, "Ivan"s);
+        assert(person.id == ID && person.name == "Ivan"s);
+        people.Emplace(people.begin(), ID + 1, "Petr"s);
+        assert(people[0].id == ID + 1 && people[0].name == "Petr"s);
+        assert(people[1].name == "Ivan"s);
+    }
+    {
+        InplaceVector<TestObj, 2> v(1);
+        // Вставка существующего элемента вектора должна быть безопасна
+        v.Emplace(v.begin(), v[0]);
+        assert(v[0].IsAlive());
+        assert(v[1].IsAlive());
+    }
+    {
+        Obj::ResetCounters();
+        Obj::default_construction_throw_countdown = 3;
+        InplaceVector<Obj, SIZE> v;
+        try {
+            v.Resize(SIZE);
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error&) {
+        }
+        assert(v.Size() == 2);
+        assert(Obj::GetAliveObjectCount() == 2);
+    }
+}
+
 int main() {
     try {
         Test1();
@@ -388,6 +781,10 @@ int main() {
         Test3();
         Test4();
         Test5();
+        Test6();
+        Test7();
+        Test8();
+        Test9();
     } catch (const std::exception& e) {
         std::cerr << e.what() << std::endl;
     }
@@ -0,0 +1,339 @@
+#pragma once
+#include "vector.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+// Размер кэш-линии, по которому разносятся счётчики производителя и потребителя,
+// чтобы они не вызывали ложного разделения (false sharing)
+inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+namespace ring_buffer_detail {
+
+// Округляет ёмкость вверх до степени двойки, чтобы индекс ячейки вычислялся маской.
+// Выбрасывает std::length_error, если буфер из элементов размером element_size
+// не помещается в адресное пространство
+inline size_t RoundUpToPowerOfTwo(size_t n, size_t element_size) {
+    if (n > (std::numeric_limits<size_t>::max() >> 1) + 1) {
+        throw std::length_error("Ring buffer capacity is too large");
+    }
+    size_t result = 1;
+    while (result < n) {
+        result <<= 1;
+    }
+    if (result > std::numeric_limits<size_t>::max() / element_size) {
+        throw std::length_error("Ring buffer capacity is too large");
+    }
+    return result;
+}
+
+}  // namespace ring_buffer_detail
+
+// Кольцевой буфер фиксированной ёмкости для одного производителя и одного потребителя.
+// Методы TryEmplace/TryPush/TryPushBatch вызываются только из потока-производителя,
+// TryPop/TryPopBatch — только из потока-потребителя
+template <typename T>
+class SpscRingBuffer {
+public:
+    // Фактическая ёмкость округляется вверх до степени двойки
+    explicit SpscRingBuffer(size_t capacity)
+        : data_(ring_buffer_detail::RoundUpToPowerOfTwo(capacity, sizeof(T)))
+        , mask_(data_.Capacity() - 1) {
+    }
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    ~SpscRingBuffer() {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        for (size_t pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos) {
+            std::destroy_at(data_ + (pos & mask_));
+        }
+    }
+
+    size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    // Приблизительный размер: при одновременной работе потоков может сразу устареть
+    size_t Size() const noexcept {
+        // head читается первым: tail не убывает, поэтому разность не уходит в минус
+        const size_t head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    bool Empty() const noexcept {
+        return Size() == 0;
+    }
+
+    // Конструирует элемент прямо в ячейке буфера. Возвращает false, если буфер полон
+    template <typename... Args>
+    bool TryEmplace(Args&&... args) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ == Capacity()) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ == Capacity()) {
+                return false;
+            }
+        }
+        new (data_ + (tail & mask_)) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPush(const T& value) {
+        return TryEmplace(value);
+    }
+
+    bool TryPush(T&& value) {
+        return TryEmplace(std::move(value));
+    }
+
+    // Извлекает элемент в value. Возвращает false, если буфер пуст
+    bool TryPop(T& value) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_) {
+                return false;
+            }
+        }
+        T* slot = data_ + (head & mask_);
+        value = std::move(*slot);
+        std::destroy_at(slot);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Копирует в буфер столько элементов из [first, last), сколько помещается,
+    // и публикует их одной операцией. Возвращает число добавленных элементов.
+    // Для перемещения элементов передайте std::move_iterator
+    template <typename ForwardIt>
+    size_t TryPushBatch(ForwardIt first, ForwardIt last) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+        if (Capacity() - (tail - cached_head_) < count) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+        }
+        const size_t n = std::min(count, Capacity() - (tail - cached_head_));
+        size_t constructed = 0;
+        try {
+            for (; constructed < n; ++constructed, ++first) {
+                new (data_ + ((tail + constructed) & mask_)) T(*first);
+            }
+        } catch (...) {
+            // Уже сконструированные элементы остаются в буфере
+            tail_.store(tail + constructed, std::memory_order_release);
+            throw;
+        }
+        tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    // Извлекает не более max_count элементов в out и освобождает ячейки одной операцией.
+    // Возвращает число извлечённых элементов
+    template <typename OutputIt>
+    size_t TryPopBatch(OutputIt out, size_t max_count) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (cached_tail_ - head < max_count) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+        }
+        const size_t n = std::min(max_count, cached_tail_ - head);
+        size_t popped = 0;
+        try {
+            for (; popped < n; ++popped, ++out) {
+                T* slot = data_ + ((head + popped) & mask_);
+                *out = std::move(*slot);
+                std::destroy_at(slot);
+            }
+        } catch (...) {
+            head_.store(head + popped, std::memory_order_release);
+            throw;
+        }
+        head_.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+private:
+    RawMemory<T> data_;
+    size_t mask_ = 0;
+
+    // Данные потребителя
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
+    size_t cached_tail_ = 0;
+
+    // Данные производителя
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_{0};
+    size_t cached_head_ = 0;
+};
+
+// Кольцевой буфер фиксированной ёмкости для нескольких производителей и потребителей.
+// Каждая ячейка хранит номер последовательности, по которому потоки определяют,
+// свободна ли она для записи или готова к чтению (схема Д. Вьюкова)
+template <typename T>
+class MpmcRingBuffer {
+public:
+    // Фактическая ёмкость округляется вверх до степени двойки и не меньше двух:
+    // при одной ячейке номера "опубликована для pos" и "свободна для pos + 1" совпадают
+    explicit MpmcRingBuffer(size_t capacity)
+        : data_(ring_buffer_detail::RoundUpToPowerOfTwo(
+              std::max<size_t>(2, capacity), std::max(sizeof(T), sizeof(std::atomic<size_t>))))
+        , sequences_(data_.Capacity())
+        , mask_(data_.Capacity() - 1) {
+        for (size_t i = 0; i < sequences_.Capacity(); ++i) {
+            new (sequences_ + i) std::atomic<size_t>(i);
+        }
+    }
+
+    MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+    MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+
+    ~MpmcRingBuffer() {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        for (size_t pos = head_.load(std::memory_order_relaxed); pos != tail; ++pos) {
+            std::destroy_at(data_ + (pos & mask_));
+        }
+        std::destroy_n(sequences_.GetAddress(), sequences_.Capacity());
+    }
+
+    size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    // Приблизительный размер: при одновременной работе потоков может сразу устареть
+    size_t Size() const noexcept {
+        const size_t head = head_.load(std::memory_order_acquire);
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool Empty() const noexcept {
+        return Size() == 0;
+    }
+
+    // Конструирует элемент прямо в ячейке буфера. Возвращает false, если буфер полон.
+    // Если конструктор может выбросить исключение, элемент сначала создаётся вне буфера,
+    // чтобы занятая ячейка не осталась навсегда неопубликованной
+    template <typename... Args>
+    bool TryEmplace(Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<T, Args...>) {
+            return EmplaceNoThrow(std::forward<Args>(args)...);
+        } else {
+            static_assert(std::is_nothrow_move_constructible_v<T>,
+                          "MpmcRingBuffer requires nothrow move construction for throwing constructors");
+            T value(std::forward<Args>(args)...);
+            return EmplaceNoThrow(std::move(value));
+        }
+    }
+
+    bool TryPush(const T& value) {
+        return TryEmplace(value);
+    }
+
+    bool TryPush(T&& value) {
+        return TryEmplace(std::move(value));
+    }
+
+    // Извлекает элемент в value. Возвращает false, если буфер пуст
+    bool TryPop(T& value) {
+        return PopWith([&value](T& slot) {
+            value = std::move(slot);
+        });
+    }
+
+    // Добавляет элементы из [first, last), пока в буфере есть место.
+    // Каждый элемент публикуется отдельно, поэтому между ними могут оказаться
+    // элементы других производителей. Возвращает число добавленных элементов
+    template <typename InputIt>
+    size_t TryPushBatch(InputIt first, InputIt last) {
+        size_t pushed = 0;
+        for (; first != last && TryEmplace(*first); ++first) {
+            ++pushed;
+        }
+        return pushed;
+    }
+
+    // Извлекает не более max_count элементов в out. Возвращает число извлечённых элементов
+    template <typename OutputIt>
+    size_t TryPopBatch(OutputIt out, size_t max_count) {
+        size_t popped = 0;
+        for (; popped < max_count; ++popped, ++out) {
+            const bool has_value = PopWith([&out](T& slot) {
+                *out = std::move(slot);
+            });
+            if (!has_value) {
+                break;
+            }
+        }
+        return popped;
+    }
+
+private:
+    RawMemory<T> data_;
+    RawMemory<std::atomic<size_t>> sequences_;
+    size_t mask_ = 0;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_{0};
+
+    template <typename... Args>
+    bool EmplaceNoThrow(Args&&... args) noexcept {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            const size_t seq = sequences_[pos & mask_].load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        new (data_ + (pos & mask_)) T(std::forward<Args>(args)...);
+        sequences_[pos & mask_].store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Захватывает готовую к чтению ячейку и передаёт её элемент в consume
+    template <typename Consumer>
+    bool PopWith(Consumer&& consume) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            const size_t seq = sequences_[pos & mask_].load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+        T* slot = data_ + (pos & mask_);
+        try {
+            consume(*slot);
+        } catch (...) {
+            // Элемент теряется, но ячейка возвращается производителям
+            Release(slot, pos);
+            throw;
+        }
+        Release(slot, pos);
+        return true;
+    }
+
+    void Release(T* slot, size_t pos) noexcept {
+        std::destroy_at(slot);
+        sequences_[pos & mask_].store(pos + mask_ + 1, std::memory_order_release);
+    }
+};
@@ -0,0 +1,158 @@
+// Замер пропускной способности кольцевых буферов в сравнении с очередью
+// на основе Vector под мьютексом.
+// Сборка: g++ -std=c++17 -O2 -pthread ring_buffer_benchmark.cpp
+#include "ring_buffer.h"
+#include "vector.h"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace {
+
+const size_t CAPACITY = 1024;
+const size_t BATCH_SIZE = 64;
+const int ITEMS_PER_PRODUCER = 2'000'000;
+
+// Очередь, которую заменяют кольцевые буферы: каждое извлечение сдвигает хвост вектора
+class MutexVectorQueue {
+public:
+    explicit MutexVectorQueue(size_t capacity) : capacity_(capacity) {
+        data_.Reserve(capacity);
+    }
+
+    bool TryPush(int value) {
+        std::lock_guard guard(mutex_);
+        if (data_.Size() == capacity_) {
+            return false;
+        }
+        data_.PushBack(value);
+        return true;
+    }
+
+    bool TryPop(int& value) {
+        std::lock_guard guard(mutex_);
+        if (data_.Size() == 0) {
+            return false;
+        }
+        value = data_[0];
+        data_.Erase(data_.begin());
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    Vector<int> data_;
+    size_t capacity_;
+};
+
+// Запускает producers производителей и consumers потребителей и печатает
+// число переданных элементов в секунду
+template <typename Push, typename Pop>
+void Run(const std::string& name, int producers, int consumers, Push push, Pop pop) {
+    const long long total = 1LL * producers * ITEMS_PER_PRODUCER;
+    std::atomic<long long> consumed{0};
+    Vector<std::thread> threads;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < producers; ++i) {
+        threads.EmplaceBack([&push] {
+            push(ITEMS_PER_PRODUCER);
+        });
+    }
+    for (int i = 0; i < consumers; ++i) {
+        threads.EmplaceBack([&pop, &consumed, total] {
+            pop(consumed, total);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << std::left << std::setw(24) << name << producers << "x" << consumers << "  "
+              << std::right << std::setw(8) << std::fixed << std::setprecision(2)
+              << total / elapsed.count() / 1e6 << " Mops/s" << std::endl;
+}
+
+// Поэлементная передача через любой буфер с методами TryPush/TryPop
+template <typename Queue>
+void RunSingle(const std::string& name, int producers, int consumers) {
+    Queue queue(CAPACITY);
+    Run(
+        name, producers, consumers,
+        [&queue](int count) {
+            for (int i = 0; i < count; ++i) {
+                while (!queue.TryPush(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        },
+        [&queue](std::atomic<long long>& consumed, long long total) {
+            int value = 0;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (queue.TryPop(value)) {
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+}
+
+// Пакетная передача через TryPushBatch/TryPopBatch
+template <typename Queue>
+void RunBatch(const std::string& name, int producers, int consumers) {
+    Queue queue(CAPACITY);
+    Run(
+        name, producers, consumers,
+        [&queue](int count) {
+            int batch[BATCH_SIZE];
+            for (int i = 0; i < count;) {
+                const int n = std::min(static_cast<int>(BATCH_SIZE), count - i);
+                for (int j = 0; j < n; ++j) {
+                    batch[j] = i + j;
+                }
+                int pushed = 0;
+                while (pushed < n) {
+                    const size_t result = queue.TryPushBatch(batch + pushed, batch + n);
+                    if (result == 0) {
+                        std::this_thread::yield();
+                    }
+                    pushed += static_cast<int>(result);
+                }
+                i += n;
+            }
+        },
+        [&queue](std::atomic<long long>& consumed, long long total) {
+            int batch[BATCH_SIZE];
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                const size_t n = queue.TryPopBatch(batch, BATCH_SIZE);
+                if (n > 0) {
+                    consumed.fetch_add(static_cast<long long>(n), std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+}
+
+}  // namespace
+
+int main() {
+    RunSingle<MutexVectorQueue>("mutex + Vector", 1, 1);
+    RunSingle<MutexVectorQueue>("mutex + Vector", 2, 2);
+    RunSingle<MutexVectorQueue>("mutex + Vector", 4, 4);
+
+    RunSingle<SpscRingBuffer<int>>("SpscRingBuffer", 1, 1);
+    RunBatch<SpscRingBuffer<int>>("SpscRingBuffer batch", 1, 1);
+
+    RunSingle<MpmcRingBuffer<int>>("MpmcRingBuffer", 1, 1);
+    RunSingle<MpmcRingBuffer<int>>("MpmcRingBuffer", 2, 2);
+    RunSingle<MpmcRingBuffer<int>>("MpmcRingBuffer", 4, 4);
+    RunBatch<MpmcRingBuffer<int>>("MpmcRingBuffer batch", 4, 4);
+}